@@ -0,0 +1,102 @@
+// ===================================================================================
+// BulkGenerator.h
+//
+// Header file for the bulk generation pipeline.
+// It produces many dungeons in parallel across all available cores. The seed of
+// dungeon i is derived from a master seed and i alone, so a run can be reproduced
+// (or a single map regenerated) regardless of thread count or completion order.
+// ===================================================================================
+
+#pragma once // A modern header guard to prevent this file from being included multiple times
+
+#include <fstream>          // Required for std::ofstream in BinaryFileSink
+#include "Dungeon.h"        // The dungeons being generated
+
+// --- Generation Method ---
+// Selects which algorithm the bulk generator runs for every dungeon.
+enum GenerationMethod {
+    METHOD_CELLULAR_AUTOMATA,
+    METHOD_RECURSIVE_BACKTRACKER
+};
+
+// --- Dungeon Sink ---
+// Receives each dungeon as soon as it has been generated. Calls are serialized by
+// the generator, so implementations do not need to be thread-safe. Dungeons arrive
+// in completion order, not index order; the index identifies each one.
+class DungeonSink {
+public:
+    virtual ~DungeonSink() {}
+
+    // Called once per generated dungeon. The dungeon is only valid during the call.
+    virtual void consume(int index, unsigned int seed, const Dungeon& dungeon) = 0;
+};
+
+// --- Counting Sink ---
+// Discards every dungeon and only counts them. Useful for measuring raw throughput.
+class CountingSink : public DungeonSink {
+public:
+    CountingSink();
+    void consume(int index, unsigned int seed, const Dungeon& dungeon);
+
+    // The number of dungeons received so far.
+    int count;
+};
+
+// --- Binary File Sink ---
+// Streams dungeons into a binary file as they finish. The layout is:
+//   header: "DGNB", width (uint32), height (uint32)
+//   record: index (uint32), seed (uint32), then width * height grid bytes, row by row
+// All integers are little-endian. Records follow until the end of the file.
+class BinaryFileSink : public DungeonSink {
+public:
+    // Opens (and truncates) the file and writes the header.
+    explicit BinaryFileSink(const char* path);
+
+    // Returns true if the file was opened and every write so far has succeeded.
+    // Writes are buffered, so a failure may only show up in finish().
+    bool isOpen() const;
+
+    void consume(int index, unsigned int seed, const Dungeon& dungeon);
+
+    // Flushes and closes the file. Returns true only if every record, including
+    // the ones still buffered, reached the file.
+    bool finish();
+
+private:
+    // Writes a 32-bit unsigned integer in little-endian byte order.
+    void writeUInt32(unsigned int value);
+
+    std::ofstream out;
+};
+
+// --- Bulk Statistics ---
+// Summary of a single bulk generation run.
+struct BulkStats {
+    int count;             // Number of dungeons generated.
+    int threads;           // Number of worker threads used.
+    double seconds;        // Wall-clock time of the run.
+    double mapsPerSecond;  // Throughput (count / seconds).
+};
+
+class BulkGenerator {
+public:
+    // --- Constructor ---
+    // threadCount <= 0 uses one thread per hardware core.
+    BulkGenerator(unsigned int masterSeed, GenerationMethod method, int threadCount = 0);
+
+    // --- Public Methods ---
+
+    // Returns the seed used for the dungeon at the given index. This is a pure
+    // function of (masterSeed, index), so results never depend on scheduling.
+    static unsigned int deriveSeed(unsigned int masterSeed, int index);
+
+    // Generates dungeons 0 .. count-1 and hands each one to the sink as it finishes.
+    // Each worker reuses a single Dungeon as its scratch buffer, so nothing is
+    // allocated per map.
+    BulkStats generate(int count, DungeonSink& sink);
+
+private:
+    unsigned int masterSeed;
+    GenerationMethod method;
+    int threadCount;
+};
@@ -7,6 +7,7 @@
 
 #pragma once // A modern header guard to prevent this file from being included multiple times
 
+#include <cstdint>     // Needed for the fixed-width words in GridBitset
 #include "Constants.h" // Needed for DUNGEON_WIDTH and DUNGEON_HEIGHT in PointStack
 
 // --- Point Struct ---
@@ -65,3 +66,50 @@ private:
     // An index that points to the top element of the stack.
     int top;
 };
+
+// --- Grid Bitset ---
+// One bit per grid cell, packed into 64-bit words row by row. Used for the wall
+// layer and for visible sets in Visibility.h, where it is 8x smaller than a char
+// grid and can be combined a whole word at a time.
+const int BITSET_WORDS_PER_ROW = (DUNGEON_WIDTH + 63) / 64;
+
+class GridBitset {
+public:
+    // --- Constructor ---
+    // Initializes every bit to 0.
+    GridBitset();
+
+    // --- Public Methods ---
+
+    // Clears every bit to 0.
+    void clear();
+
+    // Returns the number of bits that are set.
+    int count() const;
+
+    // Sets this bitset to the bitwise OR of itself and other.
+    void unite(const GridBitset& other);
+
+    // Returns the bit at (x, y). Coordinates must be in bounds.
+    // The per-cell accessors are defined inline because they sit in the inner
+    // loops of field-of-view and line-of-sight queries.
+    bool test(int x, int y) const {
+        return (words[y][x >> 6] >> (x & 63)) & 1;
+    }
+
+    // Sets the bit at (x, y) to 1. Coordinates must be in bounds.
+    void set(int x, int y) {
+        words[y][x >> 6] |= (uint64_t)1 << (x & 63);
+    }
+
+    // Resets the bit at (x, y) to 0. Coordinates must be in bounds.
+    void reset(int x, int y) {
+        words[y][x >> 6] &= ~((uint64_t)1 << (x & 63));
+    }
+
+private:
+    // --- Private Members ---
+
+    // The packed bits. Bit (x & 63) of words[y][x / 64] holds cell (x, y).
+    uint64_t words[DUNGEON_HEIGHT][BITSET_WORDS_PER_ROW];
+};
@@ -18,6 +18,10 @@ public:
     // Initializes the Dungeon object, including the random number generator.
     Dungeon();
 
+    // Initializes the Dungeon object with a known seed instead of prompting for one.
+    // Dungeons built this way generate silently, which suits batch use (see BulkGenerator.h).
+    explicit Dungeon(unsigned int seed);
+
     // --- Public Methods for Grid Management and Display ---
 
     // Fills the entire grid with a specified character.
@@ -32,6 +36,18 @@ public:
     // Safely sets a character at a specific (x, y) coordinate on the grid.
     void setChar(int x, int y, char c);
 
+    // Returns the character at (x, y), or WALL_CHAR if the coordinate is out of bounds.
+    char getChar(int x, int y) const;
+
+    // Returns a pointer to the DUNGEON_WIDTH characters making up row y of the grid.
+    const char* getRow(int y) const;
+
+    // Fills walls with one bit per cell: set where the grid holds WALL_CHAR.
+    void buildWallLayer(GridBitset& walls) const;
+
+    // Restarts the random number generator so the next generation is reproducible.
+    void setSeed(unsigned int seed);
+
     // --- Public Methods for Dungeon Generation ---
 
     // Generates a cave-like dungeon using the Cellular Automata algorithm.
@@ -55,6 +71,9 @@ private:
     // An instance of the pseudo-random number generator for all random operations.
     SimplePRNG prng;
 
+    // Whether generation and pathfinding report their progress on the console.
+    bool verbose;
+
     // --- Private Helper Methods for Pathfinding ---
 
     // Backtracks from the end node to the start node to draw the final path on the grid.
@@ -0,0 +1,105 @@
+// ===================================================================================
+// ImageExport.h
+//
+// Header file for the ImageExporter class.
+// It writes a dungeon out as a PPM or PNG image, one pixel row at a time through
+// fixed-size buffers, so the full image never has to exist in memory. The PNG
+// writer uses uncompressed ("stored") deflate blocks and therefore needs no zlib.
+// The grid itself is fixed at DUNGEON_WIDTH x DUNGEON_HEIGHT cells; large images
+// come from scaling each cell up with cellSize, and the row buffer grows with it.
+// ===================================================================================
+
+#pragma once // A modern header guard to prevent this file from being included multiple times
+
+#include <fstream>          // Required for std::ofstream
+#include <vector>           // Required for the row buffer and component labels
+#include "Dungeon.h"        // The dungeon being exported
+
+// --- Color Struct ---
+// A single 8-bit-per-channel RGB colour.
+struct Color {
+    unsigned char r;
+    unsigned char g;
+    unsigned char b;
+};
+
+// --- Image Format ---
+enum ImageFormat {
+    IMAGE_PPM,  // Binary PPM (P6): a tiny header followed by raw RGB rows.
+    IMAGE_PNG   // PNG with stored (uncompressed) deflate blocks.
+};
+
+// --- Export Options ---
+struct ImageExportOptions {
+    // Initializes the options with their defaults (4 pixels per cell, no component colours).
+    ImageExportOptions();
+
+    // The largest accepted cellSize; keeps a single pixel row comfortably inside an int.
+    static const int MAX_CELL_SIZE = 100000;
+
+    int cellSize;          // Width and height of each grid cell in pixels (1 .. MAX_CELL_SIZE).
+    bool colorComponents;  // Give each 8-connected floor region its own colour.
+};
+
+class ImageExporter {
+public:
+    // --- Constructor ---
+    explicit ImageExporter(const ImageExportOptions& options);
+
+    // --- Public Methods ---
+
+    // Writes the dungeon to path in the given format. Path cells drawn by
+    // Dungeon::findPath and the START_CHAR / END_CHAR markers are overlaid in
+    // their own colours. Returns false if the options are invalid or writing fails.
+    bool write(const Dungeon& dungeon, const char* path, ImageFormat format);
+
+    // Picks IMAGE_PNG for paths ending in ".png" and IMAGE_PPM for anything else.
+    static ImageFormat formatFromPath(const char* path);
+
+private:
+    // --- Private Members ---
+
+    ImageExportOptions options;
+
+    // Connected-component label per cell (-1 for walls), filled when colorComponents is set.
+    std::vector<int> labels;
+
+    // One pixel row: a leading PNG filter byte, then width * 3 RGB bytes.
+    std::vector<unsigned char> rowBuffer;
+
+    // The pending deflate stored block; 65535 bytes is the most one block can hold.
+    unsigned char block[65535];
+    int blockLength;
+
+    // Running Adler-32 checksum of the uncompressed image data (the zlib trailer).
+    unsigned int adler;
+
+    std::ofstream out;
+
+    // --- Private Helper Methods ---
+
+    // Labels the 8-connected regions of non-wall cells with a flood fill.
+    void labelComponents(const Dungeon& dungeon);
+
+    // Returns the colour used for cell (x, y).
+    Color cellColor(const Dungeon& dungeon, int x, int y) const;
+
+    // Expands grid row y into rowBuffer, repeating each cell cellSize times.
+    void renderRow(const Dungeon& dungeon, int y);
+
+    // The format-specific writers.
+    void writePPM(const Dungeon& dungeon);
+    void writePNG(const Dungeon& dungeon);
+
+    // Appends bytes of the zlib stream's payload, flushing full stored blocks as IDAT chunks.
+    void appendImageData(const unsigned char* data, int length);
+
+    // Emits the pending block as an IDAT chunk; isFinal marks the last deflate block.
+    void flushBlock(bool isFinal);
+
+    // Writes a complete PNG chunk: length, type, data, and CRC.
+    void writeChunk(const char* type, const unsigned char* data, int length);
+
+    // Writes a 32-bit unsigned integer in big-endian byte order, as PNG requires.
+    void writeUInt32BE(unsigned int value);
+};
@@ -0,0 +1,84 @@
+// ===================================================================================
+// Visibility.h
+//
+// Header file for the Visibility class.
+// It answers field-of-view and line-of-sight queries against a bit-packed wall
+// layer taken from a Dungeon. Visible sets are returned as GridBitsets.
+// ===================================================================================
+
+#pragma once // A modern header guard to prevent this file from being included multiple times
+
+#include <vector>           // Required for the precomputed visibility table
+#include "DataStructures.h" // Includes Point and GridBitset
+#include "Dungeon.h"        // The dungeon the wall layer is built from
+
+class Visibility {
+public:
+    // --- Constructor ---
+    // Builds the wall layer from the dungeon's current grid. Later changes to the
+    // dungeon are not seen until rebuild() is called.
+    explicit Visibility(const Dungeon& dungeon);
+
+    // Rebuilds the wall layer from the dungeon and discards any precomputed table.
+    void rebuild(const Dungeon& dungeon);
+
+    // --- Field of View ---
+
+    // Computes every cell visible from origin using recursive shadowcasting.
+    // Walls that are seen are included in the result, so room outlines show up.
+    // A radius <= 0 means unlimited range.
+    // Shadowcasting is not symmetric: b may be in the FOV of a while a is not in
+    // the FOV of b. It also disagrees with hasLineOfSight() for a few percent of
+    // cell pairs, in both directions, because the two trace different lines.
+    void computeFOV(Point origin, int radius, GridBitset& visible) const;
+
+    // Runs computeFOV for every floor cell and stores the results, so later
+    // lookups through getPrecomputedFOV() are free. Each cell keeps a full-grid
+    // bitset, so memory grows with the square of the grid area
+    // ((W * H) * (W * H) / 8 bytes, about 790 KB at the default 79x25). That is
+    // cheap for the fixed grid in Constants.h but would not scale to large maps.
+    void precomputeAll(int radius);
+
+    // Returns the stored field of view for a floor cell, or NULL if precomputeAll()
+    // has not been run or the cell is a wall or out of bounds.
+    const GridBitset* getPrecomputedFOV(Point p) const;
+
+    // --- Line of Sight ---
+
+    // Returns true if no wall lies strictly between from and to along a Bresenham
+    // line. The endpoints themselves may be walls. Out-of-bounds points are never visible.
+    // The line is always walked from the endpoint that comes first in row-major
+    // order, so the result is symmetric: hasLineOfSight(a, b) == hasLineOfSight(b, a).
+    // It is not the same test as computeFOV(); see the note there.
+    bool hasLineOfSight(Point from, Point to) const;
+
+    // Tests line of sight from one point to many targets, writing one result per
+    // target into results. Returns the number of visible targets.
+    int batchLineOfSight(Point from, const Point* targets, int count, bool* results) const;
+
+    // Returns the bit-packed wall layer the queries run against.
+    const GridBitset& getWalls() const;
+
+private:
+    // --- Private Members ---
+
+    // One bit per cell, set where the dungeon has a wall.
+    GridBitset walls;
+
+    // Field of view per cell, indexed by y * DUNGEON_WIDTH + x. Empty until precomputeAll().
+    // One full GridBitset per cell, so its size is quadratic in the grid area.
+    std::vector<GridBitset> table;
+
+    // Marks which entries of table hold a result (floor cells only).
+    GridBitset tableValid;
+
+    // --- Private Helper Methods ---
+
+    // Returns true for walls and for anything outside the grid.
+    bool isOpaque(int x, int y) const;
+
+    // Scans one octant row by row, recursing whenever a wall splits the light cone.
+    // The xx/xy/yx/yy multipliers map octant-local (dx, dy) onto grid coordinates.
+    void castLight(Point origin, int row, float startSlope, float endSlope, int radius,
+                   int xx, int xy, int yx, int yy, GridBitset& visible) const;
+};
@@ -0,0 +1,144 @@
+// ===================================================================================
+// BulkGenerator.cpp
+//
+// Implementation file for the bulk generation pipeline declared in BulkGenerator.h.
+// Workers pull indices from a shared atomic counter, generate into their own
+// reusable Dungeon, and pass the finished map to the sink under a mutex.
+// ===================================================================================
+
+#include "BulkGenerator.h" // Include the corresponding header file
+#include <atomic>          // Required for the shared work counter
+#include <chrono>          // Required for timing the run
+#include <mutex>           // Required for serializing sink calls
+#include <thread>          // Required for the worker threads
+#include <vector>          // Required for holding the worker threads
+
+// --- CountingSink Constructor ---
+CountingSink::CountingSink() {
+    count = 0;
+}
+
+// --- CountingSink::consume ---
+// Only counts the dungeon; its contents are ignored.
+void CountingSink::consume(int, unsigned int, const Dungeon&) {
+    ++count;
+}
+
+// --- BinaryFileSink Constructor ---
+// Opens the output file and writes the magic number and grid dimensions.
+BinaryFileSink::BinaryFileSink(const char* path) : out(path, std::ios::binary | std::ios::trunc) {
+    if (out) {
+        out.write("DGNB", 4);
+        writeUInt32(DUNGEON_WIDTH);
+        writeUInt32(DUNGEON_HEIGHT);
+    }
+}
+
+// --- BinaryFileSink::isOpen ---
+bool BinaryFileSink::isOpen() const {
+    return out.good();
+}
+
+// --- BinaryFileSink::consume ---
+// Appends one record: index, seed, and the grid written one row at a time.
+void BinaryFileSink::consume(int index, unsigned int seed, const Dungeon& dungeon) {
+    if (!out) return;
+
+    writeUInt32((unsigned int)index);
+    writeUInt32(seed);
+    for (int y = 0; y < DUNGEON_HEIGHT; ++y) {
+        out.write(dungeon.getRow(y), DUNGEON_WIDTH);
+    }
+}
+
+// --- BinaryFileSink::finish ---
+// Closing flushes the stream buffer, so the state has to be checked afterwards.
+bool BinaryFileSink::finish() {
+    if (!out.is_open()) return false;
+    out.close();
+    return !out.fail();
+}
+
+// --- BinaryFileSink::writeUInt32 ---
+void BinaryFileSink::writeUInt32(unsigned int value) {
+    char bytes[4];
+    bytes[0] = (char)(value & 0xFF);
+    bytes[1] = (char)((value >> 8) & 0xFF);
+    bytes[2] = (char)((value >> 16) & 0xFF);
+    bytes[3] = (char)((value >> 24) & 0xFF);
+    out.write(bytes, 4);
+}
+
+// --- Constructor ---
+// Stores the run configuration. The actual thread count is resolved in generate().
+BulkGenerator::BulkGenerator(unsigned int masterSeed, GenerationMethod method, int threadCount) {
+    this->masterSeed = masterSeed;
+    this->method = method;
+    this->threadCount = threadCount;
+}
+
+// --- deriveSeed ---
+// Mixes the master seed and the index with a SplitMix-style finalizer. Neighbouring
+// indices end up with unrelated seeds, which matters because SimplePRNG is an LCG
+// and nearby seeds would otherwise produce visibly correlated dungeons.
+unsigned int BulkGenerator::deriveSeed(unsigned int masterSeed, int index) {
+    unsigned int z = masterSeed + 0x9E3779B9u * ((unsigned int)index + 1);
+    z = (z ^ (z >> 16)) * 0x85EBCA6Bu;
+    z = (z ^ (z >> 13)) * 0xC2B2AE35u;
+    return z ^ (z >> 16);
+}
+
+// --- generate ---
+// Runs the workers to completion and reports how long the run took.
+BulkStats BulkGenerator::generate(int count, DungeonSink& sink) {
+    BulkStats stats;
+    stats.count = count > 0 ? count : 0;
+
+    int workers = threadCount;
+    if (workers <= 0) {
+        workers = (int)std::thread::hardware_concurrency();
+        if (workers <= 0) workers = 1; // hardware_concurrency() may report 0 if unknown
+    }
+    if (workers > stats.count) workers = stats.count > 0 ? stats.count : 1;
+    stats.threads = workers;
+
+    std::atomic<int> nextIndex(0);
+    std::mutex sinkMutex;
+
+    // Each worker owns one Dungeon for the whole run and regenerates it in place.
+    auto work = [&]() {
+        Dungeon dungeon(0);
+        for (;;) {
+            int index = nextIndex.fetch_add(1);
+            if (index >= stats.count) break;
+
+            unsigned int seed = deriveSeed(masterSeed, index);
+            dungeon.setSeed(seed);
+            if (method == METHOD_CELLULAR_AUTOMATA) {
+                dungeon.generateCellularAutomata();
+            } else {
+                dungeon.generateRecursiveBacktracker();
+            }
+
+            std::lock_guard<std::mutex> lock(sinkMutex);
+            sink.consume(index, seed, dungeon);
+        }
+    };
+
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    // The calling thread acts as the last worker instead of sitting idle.
+    std::vector<std::thread> threads;
+    for (int i = 1; i < workers; ++i) {
+        threads.push_back(std::thread(work));
+    }
+    work();
+    for (size_t i = 0; i < threads.size(); ++i) {
+        threads[i].join();
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+    stats.seconds = elapsed.count();
+    stats.mapsPerSecond = stats.seconds > 0.0 ? stats.count / stats.seconds : 0.0;
+    return stats;
+}
@@ -2,7 +2,7 @@
 // DataStructures.cpp
 //
 // Implementation file for the data structures declared in DataStructures.h.
-// Currently, this only contains the implementation for the PointStack class.
+// This contains the implementations for the PointStack and GridBitset classes.
 // ===================================================================================
 
 #include "DataStructures.h" // Include the corresponding header file
@@ -49,3 +49,45 @@ Point PointStack::peek() {
     // Return a sentinel value if the stack is empty
     return {-1, -1};
 }
+
+// --- GridBitset Constructor ---
+// Starts with every bit cleared.
+GridBitset::GridBitset() {
+    clear();
+}
+
+// --- clear ---
+// Resets every word to 0.
+void GridBitset::clear() {
+    for (int y = 0; y < DUNGEON_HEIGHT; ++y) {
+        for (int w = 0; w < BITSET_WORDS_PER_ROW; ++w) {
+            words[y][w] = 0;
+        }
+    }
+}
+
+// --- count ---
+// Counts the set bits one word at a time.
+int GridBitset::count() const {
+    int total = 0;
+    for (int y = 0; y < DUNGEON_HEIGHT; ++y) {
+        for (int w = 0; w < BITSET_WORDS_PER_ROW; ++w) {
+            uint64_t word = words[y][w];
+            while (word != 0) {
+                word &= word - 1; // Clear the lowest set bit
+                ++total;
+            }
+        }
+    }
+    return total;
+}
+
+// --- unite ---
+// Merges another bitset into this one with a word-wise OR.
+void GridBitset::unite(const GridBitset& other) {
+    for (int y = 0; y < DUNGEON_HEIGHT; ++y) {
+        for (int w = 0; w < BITSET_WORDS_PER_ROW; ++w) {
+            words[y][w] |= other.words[y][w];
+        }
+    }
+}
@@ -12,6 +12,8 @@
 // Initializes the Dungeon object. It prompts the user for a random seed
 // and then initializes the grid to be full of walls.
 Dungeon::Dungeon() {
+    verbose = true;
+
     // Prompt user for a seed to make generation unique each time.
     unsigned int seed_val;
     std::cout << "Enter a number to seed the random generator: ";
@@ -22,6 +24,14 @@ Dungeon::Dungeon() {
     initialize(WALL_CHAR);
 }
 
+// --- Seeded Constructor ---
+// Initializes the Dungeon object with the given seed without touching the console.
+Dungeon::Dungeon(unsigned int seed) {
+    verbose = false;
+    prng.setSeed(seed);
+    initialize(WALL_CHAR);
+}
+
 // --- initialize ---
 // Fills the entire grid with a specified character.
 void Dungeon::initialize(char fillChar) {
@@ -56,10 +66,12 @@ void Dungeon::print() {
     std::cout << "\n";
 
     // Print top border
-    std::cout << "   +";
+    char border[DUNGEON_WIDTH];
     for (int x = 0; x < DUNGEON_WIDTH; ++x) {
-        std::cout << "-";
+        border[x] = '-';
     }
+    std::cout << "   +";
+    std::cout.write(border, DUNGEON_WIDTH);
     std::cout << "+\n";
 
     // Print grid with Y-axis labels
@@ -68,17 +80,14 @@ void Dungeon::print() {
         if (y < 10) std::cout << " ";
         std::cout << y << " |";
 
-        for (int x = 0; x < DUNGEON_WIDTH; ++x) {
-            std::cout << grid[y][x];
-        }
+        // Write the whole row at once rather than one character at a time.
+        std::cout.write(grid[y], DUNGEON_WIDTH);
         std::cout << "|\n";
     }
 
     // Print bottom border
     std::cout << "   +";
-    for (int x = 0; x < DUNGEON_WIDTH; ++x) {
-        std::cout << "-";
-    }
+    std::cout.write(border, DUNGEON_WIDTH);
     std::cout << "+\n\n";
 }
 
@@ -96,6 +105,40 @@ void Dungeon::setChar(int x, int y, char c) {
     }
 }
 
+// --- getChar ---
+// Returns the character at the specified coordinates, treating the outside as wall.
+char Dungeon::getChar(int x, int y) const {
+    if (x >= 0 && x < DUNGEON_WIDTH && y >= 0 && y < DUNGEON_HEIGHT) {
+        return grid[y][x];
+    }
+    return WALL_CHAR;
+}
+
+// --- getRow ---
+// Gives read-only access to one full row of the grid.
+const char* Dungeon::getRow(int y) const {
+    return grid[y];
+}
+
+// --- buildWallLayer ---
+// Packs the wall cells of the grid into a bitset for the visibility queries.
+void Dungeon::buildWallLayer(GridBitset& walls) const {
+    walls.clear();
+    for (int y = 0; y < DUNGEON_HEIGHT; ++y) {
+        for (int x = 0; x < DUNGEON_WIDTH; ++x) {
+            if (grid[y][x] == WALL_CHAR) {
+                walls.set(x, y);
+            }
+        }
+    }
+}
+
+// --- setSeed ---
+// Reseeds the random number generator, e.g. before regenerating a reused Dungeon.
+void Dungeon::setSeed(unsigned int seed) {
+    prng.setSeed(seed);
+}
+
 // --- generateCellularAutomata ---
 // Generates a cave-like dungeon using cellular automata rules.
 void Dungeon::generateCellularAutomata(int iterations, int wallProbability) {
@@ -151,7 +194,7 @@ void Dungeon::generateCellularAutomata(int iterations, int wallProbability) {
             }
         }
     }
-    std::cout << "Dungeon generated with Cellular Automata.\n";
+    if (verbose) std::cout << "Dungeon generated with Cellular Automata.\n";
 }
 
 // --- generateRecursiveBacktracker ---
@@ -161,7 +204,7 @@ void Dungeon::generateRecursiveBacktracker() {
     PointStack stack;
 
     // Start at a random odd-numbered coordinate
-    Point startPos = {prng.randInt(0, DUNGEON_WIDTH / 2) * 2 + 1, prng.randInt(0, DUNGEON_HEIGHT / 2) * 2 + 1};
+    Point startPos = {prng.randInt(0, DUNGEON_WIDTH / 2 - 1) * 2 + 1, prng.randInt(0, DUNGEON_HEIGHT / 2 - 1) * 2 + 1};
     grid[startPos.y][startPos.x] = FLOOR_CHAR;
     stack.push(startPos);
 
@@ -196,7 +239,7 @@ void Dungeon::generateRecursiveBacktracker() {
             stack.pop();
         }
     }
-    std::cout << "Dungeon generated with Recursive Backtracker.\n";
+    if (verbose) std::cout << "Dungeon generated with Recursive Backtracker.\n";
 }
 
 // --- findPath ---
@@ -244,7 +287,7 @@ void Dungeon::findPath(Point start, Point end, bool useAStar) {
 
         if (current->pos.x == end.x && current->pos.y == end.y) {
             reconstructPath(current);
-            std::cout << "Path found!\n";
+            if (verbose) std::cout << "Path found!\n";
             return;
         }
 
@@ -279,7 +322,7 @@ void Dungeon::findPath(Point start, Point end, bool useAStar) {
         }
     }
     
-    std::cout << "Path not found.\n";
+    if (verbose) std::cout << "Path not found.\n";
 }
 
 // --- reconstructPath ---
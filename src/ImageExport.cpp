@@ -0,0 +1,306 @@
+// ===================================================================================
+// ImageExport.cpp
+//
+// Implementation file for the ImageExporter class.
+// Both formats are produced one pixel row at a time. For PNG, rows are packed into
+// 64 KB stored deflate blocks and each block is emitted as its own IDAT chunk, so
+// memory use is independent of the image height.
+// ===================================================================================
+
+#include "ImageExport.h" // Include the corresponding header file
+#include <cstring>       // Required for std::memcpy, std::strlen, and std::strcmp
+
+// --- Cell Colours ---
+static const Color WALL_COLOR = {40, 40, 48};
+static const Color FLOOR_COLOR = {210, 205, 190};
+static const Color PATH_COLOR = {240, 190, 20};
+static const Color START_COLOR = {40, 200, 60};
+static const Color END_COLOR = {220, 40, 40};
+
+// --- CRC Table ---
+// The 256-entry lookup table for the PNG CRC-32 polynomial.
+struct CrcTable {
+    unsigned int entries[256];
+};
+
+// --- buildCrcTable ---
+static CrcTable buildCrcTable() {
+    CrcTable table;
+    for (unsigned int n = 0; n < 256; ++n) {
+        unsigned int c = n;
+        for (int k = 0; k < 8; ++k) {
+            c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        }
+        table.entries[n] = c;
+    }
+    return table;
+}
+
+// --- crc32Update ---
+// Extends a PNG CRC-32 over more bytes. The table is a function-local static, so
+// C++11 builds it exactly once even when several exporters run concurrently.
+static unsigned int crc32Update(unsigned int crc, const unsigned char* data, int length) {
+    static const CrcTable table = buildCrcTable();
+
+    crc = ~crc;
+    for (int i = 0; i < length; ++i) {
+        crc = table.entries[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+// --- ImageExportOptions Constructor ---
+ImageExportOptions::ImageExportOptions() {
+    cellSize = 4;
+    colorComponents = false;
+}
+
+// --- Constructor ---
+ImageExporter::ImageExporter(const ImageExportOptions& options) : options(options) {
+    blockLength = 0;
+    adler = 1;
+}
+
+// --- formatFromPath ---
+// Chooses the format from the file extension (case-sensitive).
+ImageFormat ImageExporter::formatFromPath(const char* path) {
+    size_t length = std::strlen(path);
+    if (length >= 4 && std::strcmp(path + length - 4, ".png") == 0) {
+        return IMAGE_PNG;
+    }
+    return IMAGE_PPM;
+}
+
+// --- write ---
+// Validates the options, prepares the per-row state, and streams the image out.
+bool ImageExporter::write(const Dungeon& dungeon, const char* path, ImageFormat format) {
+    if (options.cellSize < 1 || options.cellSize > ImageExportOptions::MAX_CELL_SIZE) {
+        return false;
+    }
+
+    out.open(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        return false;
+    }
+
+    if (options.colorComponents) {
+        labelComponents(dungeon);
+    }
+    rowBuffer.assign(1 + (size_t)DUNGEON_WIDTH * options.cellSize * 3, 0);
+
+    if (format == IMAGE_PNG) {
+        writePNG(dungeon);
+    } else {
+        writePPM(dungeon);
+    }
+
+    // Closing flushes the last buffered bytes, so check the state only afterwards;
+    // a full disk or short write may not surface until then.
+    out.close();
+    return !out.fail();
+}
+
+// --- labelComponents ---
+// Flood-fills every region of non-wall cells, giving each a label. Regions are
+// 8-connected to match Dungeon::findPath, which also moves diagonally.
+void ImageExporter::labelComponents(const Dungeon& dungeon) {
+    labels.assign(DUNGEON_WIDTH * DUNGEON_HEIGHT, -1);
+    std::vector<int> queue(DUNGEON_WIDTH * DUNGEON_HEIGHT);
+    int nextLabel = 0;
+
+    for (int start = 0; start < DUNGEON_WIDTH * DUNGEON_HEIGHT; ++start) {
+        if (labels[start] != -1 || dungeon.getChar(start % DUNGEON_WIDTH, start / DUNGEON_WIDTH) == WALL_CHAR) {
+            continue;
+        }
+
+        int head = 0;
+        int tail = 0;
+        queue[tail++] = start;
+        labels[start] = nextLabel;
+        while (head < tail) {
+            int cell = queue[head++];
+            int x = cell % DUNGEON_WIDTH;
+            int y = cell / DUNGEON_WIDTH;
+            int dx[] = {0, 0, 1, -1, 1, -1, 1, -1};
+            int dy[] = {1, -1, 0, 0, 1, 1, -1, -1};
+            for (int i = 0; i < 8; ++i) {
+                int nx = x + dx[i];
+                int ny = y + dy[i];
+                // getChar reports out-of-bounds cells as walls, so no separate bounds check is needed.
+                if (dungeon.getChar(nx, ny) == WALL_CHAR || labels[ny * DUNGEON_WIDTH + nx] != -1) {
+                    continue;
+                }
+                labels[ny * DUNGEON_WIDTH + nx] = nextLabel;
+                queue[tail++] = ny * DUNGEON_WIDTH + nx;
+            }
+        }
+        ++nextLabel;
+    }
+}
+
+// --- cellColor ---
+// Walls, path overlay, and markers have fixed colours; floor cells may be tinted
+// by component using a hash of their label.
+Color ImageExporter::cellColor(const Dungeon& dungeon, int x, int y) const {
+    char c = dungeon.getChar(x, y);
+    if (c == WALL_CHAR) return WALL_COLOR;
+    if (c == START_CHAR) return START_COLOR;
+    if (c == END_CHAR) return END_COLOR;
+    if (c != FLOOR_CHAR) return PATH_COLOR; // Box-drawing characters from Dungeon::findPath
+
+    if (options.colorComponents) {
+        unsigned int h = (unsigned int)(labels[y * DUNGEON_WIDTH + x] + 1) * 2654435761u;
+        Color tint = {(unsigned char)(96 + (h >> 24) % 144),
+                      (unsigned char)(96 + (h >> 16) % 144),
+                      (unsigned char)(96 + (h >> 8) % 144)};
+        return tint;
+    }
+    return FLOOR_COLOR;
+}
+
+// --- renderRow ---
+// Fills rowBuffer (after the filter byte) with the pixels of one grid row.
+void ImageExporter::renderRow(const Dungeon& dungeon, int y) {
+    unsigned char* pixel = &rowBuffer[1];
+    for (int x = 0; x < DUNGEON_WIDTH; ++x) {
+        Color color = cellColor(dungeon, x, y);
+        for (int i = 0; i < options.cellSize; ++i) {
+            *pixel++ = color.r;
+            *pixel++ = color.g;
+            *pixel++ = color.b;
+        }
+    }
+}
+
+// --- writePPM ---
+// P6 header, then every pixel row written straight from the row buffer.
+void ImageExporter::writePPM(const Dungeon& dungeon) {
+    out << "P6\n" << DUNGEON_WIDTH * options.cellSize << " " << DUNGEON_HEIGHT * options.cellSize << "\n255\n";
+
+    std::streamsize rowBytes = (std::streamsize)rowBuffer.size() - 1;
+    for (int y = 0; y < DUNGEON_HEIGHT && out; ++y) {
+        renderRow(dungeon, y);
+        for (int i = 0; i < options.cellSize; ++i) {
+            out.write(reinterpret_cast<const char*>(&rowBuffer[1]), rowBytes);
+        }
+    }
+}
+
+// --- writePNG ---
+// Signature, IHDR, a zlib stream of stored blocks split over IDAT chunks, and IEND.
+void ImageExporter::writePNG(const Dungeon& dungeon) {
+    static const unsigned char signature[8] = {137, 'P', 'N', 'G', '\r', '\n', 26, '\n'};
+    out.write(reinterpret_cast<const char*>(signature), 8);
+
+    unsigned int width = (unsigned int)(DUNGEON_WIDTH * options.cellSize);
+    unsigned int height = (unsigned int)(DUNGEON_HEIGHT * options.cellSize);
+    unsigned char header[13] = {
+        (unsigned char)(width >> 24), (unsigned char)(width >> 16), (unsigned char)(width >> 8), (unsigned char)width,
+        (unsigned char)(height >> 24), (unsigned char)(height >> 16), (unsigned char)(height >> 8), (unsigned char)height,
+        8,  // Bit depth
+        2,  // Colour type: RGB
+        0,  // Compression method: deflate
+        0,  // Filter method: adaptive (every row here uses filter type 0, "None")
+        0   // Interlace method: none
+    };
+    writeChunk("IHDR", header, 13);
+
+    // zlib header: deflate with a 32K window, no preset dictionary, check bits valid.
+    static const unsigned char zlibHeader[2] = {0x78, 0x01};
+    writeChunk("IDAT", zlibHeader, 2);
+
+    blockLength = 0;
+    adler = 1;
+    rowBuffer[0] = 0; // Filter type "None" for every scanline
+    for (int y = 0; y < DUNGEON_HEIGHT && out; ++y) {
+        renderRow(dungeon, y);
+        for (int i = 0; i < options.cellSize; ++i) {
+            appendImageData(&rowBuffer[0], (int)rowBuffer.size());
+        }
+    }
+    flushBlock(true);
+
+    unsigned char trailer[4] = {(unsigned char)(adler >> 24), (unsigned char)(adler >> 16),
+                                (unsigned char)(adler >> 8), (unsigned char)adler};
+    writeChunk("IDAT", trailer, 4);
+    writeChunk("IEND", NULL, 0);
+}
+
+// --- appendImageData ---
+// Copies bytes into the pending block, updating the Adler-32 checksum first.
+// A full block is only flushed once more data arrives, so the last block can be
+// marked final.
+void ImageExporter::appendImageData(const unsigned char* data, int length) {
+    // 5552 is the longest run whose sums cannot overflow 32 bits before the modulo.
+    unsigned int a = adler & 0xFFFF;
+    unsigned int b = adler >> 16;
+    for (int start = 0; start < length; start += 5552) {
+        int end = start + 5552 < length ? start + 5552 : length;
+        for (int i = start; i < end; ++i) {
+            a += data[i];
+            b += a;
+        }
+        a %= 65521;
+        b %= 65521;
+    }
+    adler = (b << 16) | a;
+
+    while (length > 0) {
+        if (blockLength == (int)sizeof(block)) {
+            flushBlock(false);
+        }
+        int amount = (int)sizeof(block) - blockLength;
+        if (amount > length) amount = length;
+
+        std::memcpy(block + blockLength, data, amount);
+        blockLength += amount;
+        data += amount;
+        length -= amount;
+    }
+}
+
+// --- flushBlock ---
+// Wraps the pending bytes in a stored-block header and writes them as one IDAT chunk.
+void ImageExporter::flushBlock(bool isFinal) {
+    unsigned char storedHeader[5] = {
+        (unsigned char)(isFinal ? 1 : 0),
+        (unsigned char)(blockLength & 0xFF), (unsigned char)(blockLength >> 8),
+        (unsigned char)(~blockLength & 0xFF), (unsigned char)((~blockLength >> 8) & 0xFF)
+    };
+
+    unsigned int crc = crc32Update(0, reinterpret_cast<const unsigned char*>("IDAT"), 4);
+    crc = crc32Update(crc, storedHeader, 5);
+    crc = crc32Update(crc, block, blockLength);
+
+    writeUInt32BE((unsigned int)(5 + blockLength));
+    out.write("IDAT", 4);
+    out.write(reinterpret_cast<const char*>(storedHeader), 5);
+    out.write(reinterpret_cast<const char*>(block), blockLength);
+    writeUInt32BE(crc);
+
+    blockLength = 0;
+}
+
+// --- writeChunk ---
+// Writes a small PNG chunk whose data is already in memory.
+void ImageExporter::writeChunk(const char* type, const unsigned char* data, int length) {
+    unsigned int crc = crc32Update(0, reinterpret_cast<const unsigned char*>(type), 4);
+    crc = crc32Update(crc, data, length);
+
+    writeUInt32BE((unsigned int)length);
+    out.write(type, 4);
+    if (length > 0) {
+        out.write(reinterpret_cast<const char*>(data), length);
+    }
+    writeUInt32BE(crc);
+}
+
+// --- writeUInt32BE ---
+void ImageExporter::writeUInt32BE(unsigned int value) {
+    char bytes[4];
+    bytes[0] = (char)((value >> 24) & 0xFF);
+    bytes[1] = (char)((value >> 16) & 0xFF);
+    bytes[2] = (char)((value >> 8) & 0xFF);
+    bytes[3] = (char)(value & 0xFF);
+    out.write(bytes, 4);
+}
@@ -0,0 +1,187 @@
+// ===================================================================================
+// Visibility.cpp
+//
+// Implementation file for the Visibility class.
+// Field of view uses recursive shadowcasting over the eight octants around the
+// viewer; line of sight walks a Bresenham line over the packed wall layer.
+// ===================================================================================
+
+#include "Visibility.h" // Include the corresponding header file
+#include <cstddef>      // Required for NULL
+
+// --- Constructor ---
+// Packs the dungeon's walls into the bitset used by every query.
+Visibility::Visibility(const Dungeon& dungeon) {
+    rebuild(dungeon);
+}
+
+// --- rebuild ---
+// Refreshes the wall layer; any precomputed table no longer matches it.
+void Visibility::rebuild(const Dungeon& dungeon) {
+    dungeon.buildWallLayer(walls);
+    table.clear();
+    tableValid.clear();
+}
+
+// --- computeFOV ---
+// Lights the origin, then shadowcasts each of the eight octants.
+void Visibility::computeFOV(Point origin, int radius, GridBitset& visible) const {
+    visible.clear();
+    if (origin.x < 0 || origin.x >= DUNGEON_WIDTH || origin.y < 0 || origin.y >= DUNGEON_HEIGHT) {
+        return;
+    }
+    if (radius <= 0) {
+        radius = DUNGEON_WIDTH + DUNGEON_HEIGHT; // Further than any cell on the grid
+    }
+
+    visible.set(origin.x, origin.y);
+
+    // Multipliers that transform octant 0 into each of the eight octants.
+    static const int mult[4][8] = {
+        {1, 0, 0, -1, -1, 0, 0, 1},
+        {0, 1, -1, 0, 0, -1, 1, 0},
+        {0, 1, 1, 0, 0, -1, -1, 0},
+        {1, 0, 0, 1, -1, 0, 0, -1}
+    };
+    for (int octant = 0; octant < 8; ++octant) {
+        castLight(origin, 1, 1.0f, 0.0f, radius,
+                  mult[0][octant], mult[1][octant], mult[2][octant], mult[3][octant], visible);
+    }
+}
+
+// --- castLight ---
+// Private helper that scans rows outward from the origin between two slopes.
+// When a run of walls ends, the scan narrows; when one starts, the part of the
+// cone before it is handed to a recursive call for the following rows.
+void Visibility::castLight(Point origin, int row, float startSlope, float endSlope, int radius,
+                           int xx, int xy, int yx, int yy, GridBitset& visible) const {
+    if (startSlope < endSlope) return;
+
+    int radiusSquared = radius * radius;
+    float newStart = 0.0f;
+
+    for (int j = row; j <= radius; ++j) {
+        int dy = -j;
+        bool blocked = false;
+
+        for (int dx = -j; dx <= 0; ++dx) {
+            int x = origin.x + dx * xx + dy * xy;
+            int y = origin.y + dx * yx + dy * yy;
+            float leftSlope = (dx - 0.5f) / (dy + 0.5f);
+            float rightSlope = (dx + 0.5f) / (dy - 0.5f);
+
+            if (startSlope < rightSlope) continue;
+            if (endSlope > leftSlope) break;
+
+            bool inBounds = x >= 0 && x < DUNGEON_WIDTH && y >= 0 && y < DUNGEON_HEIGHT;
+            if (inBounds && dx * dx + dy * dy <= radiusSquared) {
+                visible.set(x, y);
+            }
+
+            bool opaque = isOpaque(x, y);
+            if (blocked) {
+                if (opaque) {
+                    // Still inside a run of walls: keep pushing the start of the cone back.
+                    newStart = rightSlope;
+                    continue;
+                }
+                // The run of walls has ended; light resumes from its far edge.
+                blocked = false;
+                startSlope = newStart;
+            } else if (opaque && j < radius) {
+                // A wall starts here: light the unblocked part of the cone beyond this row.
+                blocked = true;
+                castLight(origin, j + 1, startSlope, leftSlope, radius, xx, xy, yx, yy, visible);
+                newStart = rightSlope;
+            }
+        }
+
+        if (blocked) break;
+    }
+}
+
+// --- precomputeAll ---
+// Stores a field of view for every floor cell of the dungeon.
+void Visibility::precomputeAll(int radius) {
+    table.assign(DUNGEON_WIDTH * DUNGEON_HEIGHT, GridBitset());
+    tableValid.clear();
+
+    for (int y = 0; y < DUNGEON_HEIGHT; ++y) {
+        for (int x = 0; x < DUNGEON_WIDTH; ++x) {
+            if (walls.test(x, y)) continue;
+            Point p = {x, y};
+            computeFOV(p, radius, table[y * DUNGEON_WIDTH + x]);
+            tableValid.set(x, y);
+        }
+    }
+}
+
+// --- getPrecomputedFOV ---
+// Looks up a stored field of view, if there is one for this cell.
+const GridBitset* Visibility::getPrecomputedFOV(Point p) const {
+    if (p.x < 0 || p.x >= DUNGEON_WIDTH || p.y < 0 || p.y >= DUNGEON_HEIGHT) return NULL;
+    if (!tableValid.test(p.x, p.y)) return NULL;
+    return &table[p.y * DUNGEON_WIDTH + p.x];
+}
+
+// --- hasLineOfSight ---
+// Walks an integer Bresenham line and stops at the first wall between the endpoints.
+// Bresenham picks different cells depending on which end it starts from, so the
+// endpoints are put in a fixed order first to make the answer symmetric.
+bool Visibility::hasLineOfSight(Point from, Point to) const {
+    if (from.x < 0 || from.x >= DUNGEON_WIDTH || from.y < 0 || from.y >= DUNGEON_HEIGHT ||
+        to.x < 0 || to.x >= DUNGEON_WIDTH || to.y < 0 || to.y >= DUNGEON_HEIGHT) {
+        return false;
+    }
+    if (from.x == to.x && from.y == to.y) return true;
+    if (to.y < from.y || (to.y == from.y && to.x < from.x)) {
+        Point swap = from;
+        from = to;
+        to = swap;
+    }
+
+    int dx = to.x > from.x ? to.x - from.x : from.x - to.x;
+    int dy = to.y > from.y ? to.y - from.y : from.y - to.y;
+    int stepX = from.x < to.x ? 1 : -1;
+    int stepY = from.y < to.y ? 1 : -1;
+    int error = dx - dy;
+
+    int x = from.x;
+    int y = from.y;
+    for (;;) {
+        int doubledError = 2 * error;
+        if (doubledError > -dy) {
+            error -= dy;
+            x += stepX;
+        }
+        if (doubledError < dx) {
+            error += dx;
+            y += stepY;
+        }
+        if (x == to.x && y == to.y) return true;
+        if (walls.test(x, y)) return false;
+    }
+}
+
+// --- batchLineOfSight ---
+// Runs hasLineOfSight for every target against the same wall layer.
+int Visibility::batchLineOfSight(Point from, const Point* targets, int count, bool* results) const {
+    int visibleCount = 0;
+    for (int i = 0; i < count; ++i) {
+        results[i] = hasLineOfSight(from, targets[i]);
+        if (results[i]) ++visibleCount;
+    }
+    return visibleCount;
+}
+
+// --- getWalls ---
+const GridBitset& Visibility::getWalls() const {
+    return walls;
+}
+
+// --- isOpaque ---
+// Treats everything outside the grid as solid wall.
+bool Visibility::isOpaque(int x, int y) const {
+    if (x < 0 || x >= DUNGEON_WIDTH || y < 0 || y >= DUNGEON_HEIGHT) return true;
+    return walls.test(x, y);
+}
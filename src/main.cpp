@@ -7,7 +7,15 @@
 // ===================================================================================
 
 #include <iostream>     // For console input and output (cin, cout)
+#include <cstdlib>      // For std::strtol and std::strtoul when parsing command-line arguments
+#include <cstring>      // For std::strcmp when parsing command-line arguments
+#include <chrono>       // For timing the --fov and --image modes
+#include <vector>       // For the cell list in the --fov benchmark
+#include <memory>       // For std::unique_ptr holding the --fov result buffer
 #include "Dungeon.h"      // The main header for the Dungeon class and all its functionality
+#include "BulkGenerator.h" // Parallel generation of many dungeons for the --bulk mode
+#include "Visibility.h"    // Field-of-view and line-of-sight queries for the --fov mode
+#include "ImageExport.h"   // PPM/PNG export for the --image mode
 
 // --- printMenu ---
 // Displays the main menu of options to the user.
@@ -25,9 +33,254 @@ void printMenu() {
     std::cout << "Enter your choice: ";
 }
 
+// --- parseInt ---
+// Parses a whole command-line argument as a decimal integer.
+// Returns false if the text is empty, has trailing characters, or does not fit in an int.
+bool parseInt(const char* text, int& value) {
+    char* end = NULL;
+    long parsed = std::strtol(text, &end, 10);
+    if (end == text || *end != '\0' || parsed < -2147483647L || parsed > 2147483647L) {
+        return false;
+    }
+    value = (int)parsed;
+    return true;
+}
+
+// --- parseUnsigned ---
+// Parses a whole command-line argument as a decimal unsigned 32-bit integer (e.g. a seed).
+// Returns false if the text is empty, negative, has trailing characters, or is too large.
+bool parseUnsigned(const char* text, unsigned int& value) {
+    if (*text == '-') {
+        return false; // strtoul would silently wrap negative numbers around
+    }
+    char* end = NULL;
+    unsigned long parsed = std::strtoul(text, &end, 10);
+    if (end == text || *end != '\0' || parsed > 4294967295UL) {
+        return false;
+    }
+    value = (unsigned int)parsed;
+    return true;
+}
+
+// --- runBulkMode ---
+// Non-interactive mode: dungeon --bulk <count> <masterSeed> [cave|maze] [output.bin]
+// Generates <count> dungeons on all cores and streams them to output.bin if given.
+// Returns the process exit code.
+int runBulkMode(int argc, char* argv[]) {
+    if (argc < 4) {
+        std::cout << "Usage: " << argv[0] << " --bulk <count> <masterSeed> [cave|maze] [output.bin]\n";
+        return 1;
+    }
+
+    int count = 0;
+    if (!parseInt(argv[2], count) || count <= 0) {
+        std::cout << "Error: invalid count '" << argv[2] << "' (expected a positive number).\n";
+        return 1;
+    }
+    unsigned int masterSeed = 0;
+    if (!parseUnsigned(argv[3], masterSeed)) {
+        std::cout << "Error: invalid master seed '" << argv[3] << "' (expected 0 to 4294967295).\n";
+        return 1;
+    }
+    GenerationMethod method = METHOD_CELLULAR_AUTOMATA;
+    if (argc > 4) {
+        if (std::strcmp(argv[4], "maze") == 0) {
+            method = METHOD_RECURSIVE_BACKTRACKER;
+        } else if (std::strcmp(argv[4], "cave") != 0) {
+            std::cout << "Error: unknown method '" << argv[4] << "' (expected cave or maze).\n";
+            return 1;
+        }
+    }
+    BulkGenerator generator(masterSeed, method);
+    BulkStats stats;
+    if (argc > 5) {
+        BinaryFileSink sink(argv[5]);
+        if (!sink.isOpen()) {
+            std::cout << "Error: could not open '" << argv[5] << "' for writing.\n";
+            return 1;
+        }
+        stats = generator.generate(count, sink);
+        if (!sink.finish()) {
+            std::cout << "Error: writing to '" << argv[5] << "' failed.\n";
+            return 1;
+        }
+    } else {
+        CountingSink sink;
+        stats = generator.generate(count, sink);
+    }
+
+    std::cout << "Generated " << stats.count << " dungeons on " << stats.threads << " threads in "
+              << stats.seconds << " s (" << stats.mapsPerSecond << " maps/s).\n";
+    return 0;
+}
+
+// --- runFovMode ---
+// Non-interactive mode: dungeon --fov <seed> [cave|maze] [radius]
+// Generates one dungeon, precomputes the field of view of every floor cell, then
+// tests line of sight between every pair of floor cells, reporting throughput.
+// A radius of 0 (the default) means unlimited range; negative radii are rejected.
+// Returns the process exit code.
+int runFovMode(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::cout << "Usage: " << argv[0] << " --fov <seed> [cave|maze] [radius]\n";
+        return 1;
+    }
+
+    unsigned int seed = 0;
+    if (!parseUnsigned(argv[2], seed)) {
+        std::cout << "Error: invalid seed '" << argv[2] << "' (expected 0 to 4294967295).\n";
+        return 1;
+    }
+    int radius = 0;
+    if (argc > 4 && (!parseInt(argv[4], radius) || radius < 0)) {
+        std::cout << "Error: invalid radius '" << argv[4] << "' (expected 0 for unlimited, or a positive number).\n";
+        return 1;
+    }
+
+    Dungeon dungeon(seed);
+    if (argc > 3 && std::strcmp(argv[3], "maze") == 0) {
+        dungeon.generateRecursiveBacktracker();
+    } else if (argc > 3 && std::strcmp(argv[3], "cave") != 0) {
+        std::cout << "Error: unknown method '" << argv[3] << "' (expected cave or maze).\n";
+        return 1;
+    } else {
+        dungeon.generateCellularAutomata();
+    }
+    Visibility visibility(dungeon);
+    std::vector<Point> floorCells;
+    for (int y = 0; y < DUNGEON_HEIGHT; ++y) {
+        for (int x = 0; x < DUNGEON_WIDTH; ++x) {
+            if (!visibility.getWalls().test(x, y)) {
+                Point p = {x, y};
+                floorCells.push_back(p);
+            }
+        }
+    }
+    if (floorCells.empty()) {
+        std::cout << "The dungeon has no floor cells.\n";
+        return 0;
+    }
+
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+    visibility.precomputeAll(radius);
+    std::chrono::duration<double> fovTime = std::chrono::steady_clock::now() - startTime;
+
+    long long visibleCells = 0;
+    for (size_t i = 0; i < floorCells.size(); ++i) {
+        visibleCells += visibility.getPrecomputedFOV(floorCells[i])->count();
+    }
+
+    std::unique_ptr<bool[]> results(new bool[floorCells.size()]);
+    long long losTests = 0;
+    long long losVisible = 0;
+    startTime = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < floorCells.size(); ++i) {
+        losVisible += visibility.batchLineOfSight(floorCells[i], &floorCells[0], (int)floorCells.size(),
+                                                  results.get());
+        losTests += (long long)floorCells.size();
+    }
+    std::chrono::duration<double> losTime = std::chrono::steady_clock::now() - startTime;
+
+    std::cout << "Precomputed FOV for " << floorCells.size() << " floor cells in " << fovTime.count()
+              << " s (" << floorCells.size() / fovTime.count() << " FOV/s, "
+              << (double)visibleCells / floorCells.size() << " visible cells on average).\n";
+    std::cout << "Ran " << losTests << " line-of-sight tests in " << losTime.count() << " s ("
+              << losTests / losTime.count() << " tests/s, " << losVisible << " clear).\n";
+    return 0;
+}
+
+// --- runImageMode ---
+// Non-interactive mode:
+//   dungeon --image <seed> <cave|maze> <output.ppm|output.png> [cellSize] [--components] [--path sx sy ex ey]
+// Generates one dungeon and exports it as an image. The format follows the file
+// extension. --path overlays an A* path; --components colours each floor region.
+// Returns the process exit code.
+int runImageMode(int argc, char* argv[]) {
+    if (argc < 5) {
+        std::cout << "Usage: " << argv[0] << " --image <seed> <cave|maze> <output.ppm|output.png>"
+                  << " [cellSize] [--components] [--path sx sy ex ey]\n";
+        return 1;
+    }
+
+    unsigned int seed = 0;
+    if (!parseUnsigned(argv[2], seed)) {
+        std::cout << "Error: invalid seed '" << argv[2] << "' (expected 0 to 4294967295).\n";
+        return 1;
+    }
+
+    Dungeon dungeon(seed);
+    if (std::strcmp(argv[3], "maze") == 0) {
+        dungeon.generateRecursiveBacktracker();
+    } else if (std::strcmp(argv[3], "cave") == 0) {
+        dungeon.generateCellularAutomata();
+    } else {
+        std::cout << "Error: unknown method '" << argv[3] << "' (expected cave or maze).\n";
+        return 1;
+    }
+    const char* outputPath = argv[4];
+
+    ImageExportOptions options;
+    for (int i = 5; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--components") == 0) {
+            options.colorComponents = true;
+        } else if (std::strcmp(argv[i], "--path") == 0) {
+            Point start, end;
+            if (i + 4 >= argc || !parseInt(argv[i + 1], start.x) || !parseInt(argv[i + 2], start.y) ||
+                !parseInt(argv[i + 3], end.x) || !parseInt(argv[i + 4], end.y)) {
+                std::cout << "Error: --path needs four integer coordinates (sx sy ex ey).\n";
+                return 1;
+            }
+            i += 4;
+            if (!dungeon.isInBounds(start.x, start.y) || !dungeon.isInBounds(end.x, end.y)) {
+                std::cout << "Error: One or both path coordinates are out of bounds.\n";
+                return 1;
+            }
+            dungeon.findPath(start, end, true);
+            dungeon.setChar(start.x, start.y, START_CHAR);
+            dungeon.setChar(end.x, end.y, END_CHAR);
+        } else if (i == 5) {
+            if (!parseInt(argv[i], options.cellSize) || options.cellSize < 1 ||
+                options.cellSize > ImageExportOptions::MAX_CELL_SIZE) {
+                std::cout << "Error: invalid cell size '" << argv[i] << "' (expected 1 to "
+                          << ImageExportOptions::MAX_CELL_SIZE << ").\n";
+                return 1;
+            }
+        } else {
+            std::cout << "Error: unexpected argument '" << argv[i] << "'.\n";
+            return 1;
+        }
+    }
+
+    ImageExporter exporter(options);
+    ImageFormat format = ImageExporter::formatFromPath(outputPath);
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+    if (!exporter.write(dungeon, outputPath, format)) {
+        std::cout << "Error: could not write '" << outputPath << "'.\n";
+        return 1;
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+
+    double pixels = (double)DUNGEON_WIDTH * options.cellSize * DUNGEON_HEIGHT * options.cellSize;
+    std::cout << "Wrote " << (format == IMAGE_PNG ? "PNG" : "PPM") << " image '" << outputPath << "' ("
+              << DUNGEON_WIDTH * options.cellSize << "x" << DUNGEON_HEIGHT * options.cellSize << ") in "
+              << elapsed.count() << " s (" << pixels / elapsed.count() / 1e6 << " Mpixels/s).\n";
+    return 0;
+}
+
 // --- main ---
 // The primary function where the program execution begins.
-int main() {
+int main(int argc, char* argv[]) {
+    // Command-line modes bypass the interactive menu entirely.
+    if (argc > 1 && std::strcmp(argv[1], "--bulk") == 0) {
+        return runBulkMode(argc, argv);
+    }
+    if (argc > 1 && std::strcmp(argv[1], "--fov") == 0) {
+        return runFovMode(argc, argv);
+    }
+    if (argc > 1 && std::strcmp(argv[1], "--image") == 0) {
+        return runImageMode(argc, argv);
+    }
+
     // Create the main dungeon object. This will prompt for a seed upon creation.
     Dungeon dungeon;
     bool dungeonGenerated = false;